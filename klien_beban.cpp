@@ -0,0 +1,296 @@
+// Klien pembangkit beban untuk mode server GoBusNet.
+// Mengukur throughput dan latensi (p50/p90/p99/max) dengan beberapa koneksi
+// paralel, masing-masing mengirim permintaan secara pipelined.
+//
+// Kompilasi : g++ -O2 -std=c++17 -pthread klien_beban.cpp -o klien_beban
+// Penggunaan: ./klien_beban <port | /path/socket> [koneksi] [permintaan_per_koneksi] [kedalaman_pipeline]
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <deque>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <climits>
+
+using namespace std;
+using Jam = chrono::steady_clock;
+
+// Sebagian halte dari data awal server, dipakai untuk membuat query rute
+const vector<string> DAFTAR_HALTE = {
+    "Jakarta Kota", "Bogor", "Gambir", "Depok", "Tanah Abang", "Serpong",
+    "Manggarai", "Bekasi", "Duri", "Tangerang", "Pasar Senen", "Tanjung Priok",
+    "Cawang", "Kebayoran", "Parung Panjang", "Rangkasbitung"
+};
+
+// Struktur untuk menyimpan hasil pengukuran satu koneksi
+struct HasilKoneksi {
+    vector<double> latensiMikro;  // Latensi tiap permintaan dalam mikrodetik
+    long long jumlahError;        // Jumlah respons ERR
+    bool gagal;                   // Koneksi terputus sebelum selesai
+
+    HasilKoneksi() : jumlahError(0), gagal(false) {}
+};
+
+// Function untuk mengurai bilangan bulat dalam rentang [minimum, maksimum];
+// seluruh teks harus berupa angka, tanpa melempar exception
+bool uraiAngka(const string& teks, long long minimum, long long maksimum, long long& hasil) {
+    if (teks.empty() || teks[0] < '0' || teks[0] > '9') return false;
+    errno = 0;
+    char* akhir = nullptr;
+    long long nilai = strtoll(teks.c_str(), &akhir, 10);
+    if (errno != 0 || *akhir != '\0' || nilai < minimum || nilai > maksimum) return false;
+    hasil = nilai;
+    return true;
+}
+
+// Function untuk membuka koneksi ke server (TCP localhost atau Unix socket)
+int sambungKeServer(const string& alamat) {
+    int fd;
+    if (!alamat.empty() && alamat[0] == '/') {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, alamat.c_str(), sizeof(addr.sun_path) - 1);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        long long port;
+        if (!uraiAngka(alamat, 1, 65535, port)) return -1;
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) return -1;
+        if (connect(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            close(fd);
+            return -1;
+        }
+        int aktif = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &aktif, sizeof(aktif));
+    }
+    return fd;
+}
+
+// Function untuk membuat permintaan ke-i dengan campuran query rute,
+// pencarian penumpang, dan peringkat rute
+string buatPermintaan(long long i, int idKoneksi) {
+    long long n = i + idKoneksi * 7;
+    if (n % 10 == 0) {
+        return "PERINGKAT\n";
+    }
+    if (n % 3 == 0) {
+        return "CARI_PENUMPANG " + to_string(n % 10 + 1) + "\n";
+    }
+    const string& asal = DAFTAR_HALTE[n % DAFTAR_HALTE.size()];
+    const string& tujuan = DAFTAR_HALTE[(n * 5 + 3) % DAFTAR_HALTE.size()];
+    return "RUTE " + asal + "|" + tujuan + "\n";
+}
+
+// Function untuk menjalankan beban pada satu koneksi. Socket dibuat
+// non-blocking dan dilayani dengan poll, sehingga respons tetap dibaca
+// selama permintaan dikirim. Server berhenti membaca selama responsnya
+// belum terambil, jadi mengirim seluruh jendela secara blocking sebelum
+// membaca akan membuat kedua sisi saling menunggu pada kedalaman besar
+void jalankanKoneksi(const string& alamat, int idKoneksi, long long jumlahPermintaan,
+                     int kedalaman, HasilKoneksi& hasil) {
+    int fd = sambungKeServer(alamat);
+    if (fd < 0) {
+        hasil.gagal = true;
+        return;
+    }
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+        close(fd);
+        hasil.gagal = true;
+        return;
+    }
+    hasil.latensiMikro.reserve(jumlahPermintaan);
+
+    // Permintaan baru hanya dibangkitkan selama data yang belum terkirim
+    // di bawah batas ini, agar waktu antre di klien tetap kecil
+    const size_t BATAS_BUFFER_KIRIM = 64 * 1024;
+
+    deque<Jam::time_point> waktuKirim;  // Waktu kirim permintaan yang belum dijawab
+    string bufferKirim, bufferMasuk;
+    size_t offsetKirim = 0;
+    vector<char> bufferBaca(64 * 1024);
+    long long terkirim = 0, selesai = 0;
+
+    while (selesai < jumlahPermintaan && !hasil.gagal) {
+        // Isi jendela pipeline
+        while (terkirim < jumlahPermintaan && (long long)waktuKirim.size() < kedalaman &&
+               bufferKirim.size() - offsetKirim < BATAS_BUFFER_KIRIM) {
+            bufferKirim += buatPermintaan(terkirim++, idKoneksi);
+            waktuKirim.push_back(Jam::now());
+        }
+
+        pollfd pfd;
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        if (offsetKirim < bufferKirim.size()) pfd.events |= POLLOUT;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, -1) < 0) {
+            if (errno == EINTR) continue;
+            hasil.gagal = true;
+            break;
+        }
+        if (pfd.revents & (POLLERR | POLLNVAL)) {
+            hasil.gagal = true;
+            break;
+        }
+
+        // Kirim sebanyak yang diterima socket tanpa blocking
+        if (pfd.revents & POLLOUT) {
+            while (offsetKirim < bufferKirim.size()) {
+                ssize_t n = send(fd, bufferKirim.data() + offsetKirim,
+                                 bufferKirim.size() - offsetKirim, MSG_NOSIGNAL);
+                if (n > 0) {
+                    offsetKirim += n;
+                } else if (n < 0 && errno == EINTR) {
+                    continue;
+                } else {
+                    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) hasil.gagal = true;
+                    break;
+                }
+            }
+            bufferKirim.erase(0, offsetKirim);
+            offsetKirim = 0;
+            if (hasil.gagal) break;
+        }
+
+        if (!(pfd.revents & (POLLIN | POLLHUP))) continue;
+
+        // Baca semua data yang tersedia
+        while (true) {
+            ssize_t n = recv(fd, bufferBaca.data(), bufferBaca.size(), 0);
+            if (n > 0) {
+                bufferMasuk.append(bufferBaca.data(), n);
+            } else if (n < 0 && errno == EINTR) {
+                continue;
+            } else {
+                // n == 0 berarti server menutup koneksi sebelum semua dijawab
+                if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) hasil.gagal = true;
+                break;
+            }
+        }
+
+        // Urai semua respons lengkap: "OK <n>\n" atau "ERR <n>\n" diikuti n byte
+        size_t posisi = 0;
+        while (selesai < jumlahPermintaan) {
+            size_t akhirHeader = bufferMasuk.find('\n', posisi);
+            if (akhirHeader == string::npos) break;
+            bool ok = bufferMasuk.compare(posisi, 3, "OK ") == 0;
+            bool err = bufferMasuk.compare(posisi, 4, "ERR ") == 0;
+            size_t spasi = bufferMasuk.find(' ', posisi);
+            long long panjang;
+            if ((!ok && !err) || spasi > akhirHeader || waktuKirim.empty() ||
+                !uraiAngka(bufferMasuk.substr(spasi + 1, akhirHeader - spasi - 1),
+                           0, 1LL << 30, panjang)) {
+                // Header respons rusak, koneksi tidak bisa disinkronkan lagi
+                hasil.gagal = true;
+                break;
+            }
+            if (bufferMasuk.size() < akhirHeader + 1 + panjang) break;
+
+            if (err) hasil.jumlahError++;
+            auto durasi = Jam::now() - waktuKirim.front();
+            waktuKirim.pop_front();
+            hasil.latensiMikro.push_back(chrono::duration<double, micro>(durasi).count());
+            selesai++;
+            posisi = akhirHeader + 1 + panjang;
+        }
+        bufferMasuk.erase(0, posisi);
+
+        // Koneksi tertutup tetapi semua respons sudah lengkap tetap dihitung berhasil
+        if (selesai == jumlahPermintaan) hasil.gagal = false;
+    }
+
+    close(fd);
+}
+
+// Function untuk mengambil nilai persentil dari data yang sudah terurut
+double persentil(const vector<double>& terurut, double p) {
+    if (terurut.empty()) return 0;
+    size_t indeks = (size_t)(p / 100.0 * (terurut.size() - 1) + 0.5);
+    return terurut[min(indeks, terurut.size() - 1)];
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        cerr << "Penggunaan: " << argv[0]
+             << " <port | /path/socket> [koneksi=4] [permintaan_per_koneksi=10000] [kedalaman_pipeline=16]" << endl;
+        return 1;
+    }
+    string alamat = argv[1];
+    long long port, jumlahKoneksi = 4, permintaanPerKoneksi = 10000, kedalaman = 16;
+
+    // Validasi semua argumen sebelum thread pekerja dijalankan
+    if (alamat.empty() || (alamat[0] != '/' && !uraiAngka(alamat, 1, 65535, port))) {
+        cerr << "Alamat harus port 1-65535 atau path socket absolut: " << alamat << endl;
+        return 1;
+    }
+    if ((argc > 2 && !uraiAngka(argv[2], 1, 10000, jumlahKoneksi)) ||
+        (argc > 3 && !uraiAngka(argv[3], 1, 100000000, permintaanPerKoneksi)) ||
+        (argc > 4 && !uraiAngka(argv[4], 1, 1000000, kedalaman))) {
+        cerr << "Parameter numerik tidak valid: koneksi 1-10000, permintaan 1-100000000, "
+             << "kedalaman pipeline 1-1000000." << endl;
+        return 1;
+    }
+
+    vector<HasilKoneksi> hasil(jumlahKoneksi);
+    vector<thread> pekerja;
+
+    auto mulai = Jam::now();
+    for (int i = 0; i < jumlahKoneksi; i++) {
+        pekerja.emplace_back(jalankanKoneksi, alamat, i, permintaanPerKoneksi,
+                             kedalaman, ref(hasil[i]));
+    }
+    for (thread& t : pekerja) t.join();
+    double detik = chrono::duration<double>(Jam::now() - mulai).count();
+
+    // Gabungkan hasil semua koneksi
+    vector<double> semuaLatensi;
+    long long totalError = 0;
+    int koneksiGagal = 0;
+    for (const HasilKoneksi& h : hasil) {
+        semuaLatensi.insert(semuaLatensi.end(), h.latensiMikro.begin(), h.latensiMikro.end());
+        totalError += h.jumlahError;
+        if (h.gagal) koneksiGagal++;
+    }
+    sort(semuaLatensi.begin(), semuaLatensi.end());
+
+    cout << "\n=== HASIL UJI BEBAN ===" << endl;
+    cout << fixed << setprecision(1);
+    cout << left << setw(20) << "Koneksi:" << jumlahKoneksi << " (gagal " << koneksiGagal << ")" << endl;
+    cout << left << setw(20) << "Kedalaman pipeline:" << kedalaman << endl;
+    cout << left << setw(20) << "Permintaan selesai:" << semuaLatensi.size() << " (ERR " << totalError << ")" << endl;
+    cout << left << setw(20) << "Durasi (detik):" << setprecision(3) << detik << endl;
+    cout << left << setw(20) << "Throughput (req/s):" << setprecision(0) << semuaLatensi.size() / detik << endl;
+    cout << setprecision(1);
+    cout << left << setw(20) << "Latensi p50 (us):" << persentil(semuaLatensi, 50) << endl;
+    cout << left << setw(20) << "Latensi p90 (us):" << persentil(semuaLatensi, 90) << endl;
+    cout << left << setw(20) << "Latensi p99 (us):" << persentil(semuaLatensi, 99) << endl;
+    cout << left << setw(20) << "Latensi max (us):" << (semuaLatensi.empty() ? 0 : semuaLatensi.back()) << endl;
+
+    return koneksiGagal == 0 ? 0 : 1;
+}
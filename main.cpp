@@ -6,6 +6,24 @@
 #include <queue>
 #include <climits>
 #include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
+#include <cerrno>
+
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstring>
+#include <chrono>
+#endif
 
 using namespace std;
 
@@ -53,6 +71,59 @@ private:
     
     // Vector untuk menyimpan informasi rute dan jumlah penumpangnya
     vector<InfoRute> infoRute;
+    
+    // Union-find sebagai indeks konektivitas: induk dan ukuran tiap komponen
+    unordered_map<string, string> indukKomponen;
+    unordered_map<string, int> ukuranKomponen;
+    int jumlahKomponen = 0;
+    
+    // Union-find tidak mendukung penghapusan, sehingga setelah halte/rute
+    // dihapus indeks ditandai kotor dan dibangun ulang saat query berikutnya
+    bool indeksKotor = false;
+    
+    // Method untuk mencari akar komponen sebuah halte (dengan path halving).
+    // Memakai at() agar halte yang tidak ada di indeks melempar out_of_range
+    // alih-alih diam-diam disisipkan dengan induk kosong
+    string cariAkar(const string& halte) {
+        string sekarang = halte;
+        while (true) {
+            string& induk = indukKomponen.at(sekarang);
+            if (induk == sekarang) return sekarang;
+            induk = indukKomponen.at(induk);
+            sekarang = induk;
+        }
+    }
+    
+    // Method untuk menggabungkan komponen dua halte (union by size)
+    void gabungKomponen(const string& a, const string& b) {
+        string akarA = cariAkar(a);
+        string akarB = cariAkar(b);
+        if (akarA == akarB) return;
+        if (ukuranKomponen.at(akarA) < ukuranKomponen.at(akarB)) swap(akarA, akarB);
+        indukKomponen.at(akarB) = akarA;
+        ukuranKomponen.at(akarA) += ukuranKomponen.at(akarB);
+        ukuranKomponen.erase(akarB);
+        jumlahKomponen--;
+    }
+    
+    // Method untuk membangun ulang indeks konektivitas dari graph, O(V + E)
+    void pastikanIndeksValid() {
+        if (!indeksKotor) return;
+        
+        indukKomponen.clear();
+        ukuranKomponen.clear();
+        for (const auto& pair : graph) {
+            indukKomponen[pair.first] = pair.first;
+            ukuranKomponen[pair.first] = 1;
+        }
+        jumlahKomponen = graph.size();
+        for (const auto& pair : graph) {
+            for (const Edge& edge : pair.second) {
+                gabungKomponen(pair.first, edge.tujuan);
+            }
+        }
+        indeksKotor = false;
+    }
 
 public:
     // Method untuk menambahkan halte baru ke dalam sistem
@@ -60,6 +131,12 @@ public:
         // Jika halte belum ada dalam graph, tambahkan sebagai node baru
         if (graph.find(namaHalte) == graph.end()) {
             graph[namaHalte] = vector<Edge>();
+            // Halte baru menjadi komponen tersendiri
+            if (!indeksKotor) {
+                indukKomponen[namaHalte] = namaHalte;
+                ukuranKomponen[namaHalte] = 1;
+                jumlahKomponen++;
+            }
             cout << "Halte " << namaHalte << " berhasil ditambahkan." << endl;
         } else {
             cout << "Halte " << namaHalte << " sudah ada dalam sistem." << endl;
@@ -74,6 +151,16 @@ public:
             return;
         }
         
+        // Halte tanpa rute cukup dilepas dari indeks; selain itu komponennya
+        // bisa terpecah sehingga indeks perlu dibangun ulang
+        if (graph[namaHalte].empty() && !indeksKotor) {
+            indukKomponen.erase(namaHalte);
+            ukuranKomponen.erase(namaHalte);
+            jumlahKomponen--;
+        } else {
+            indeksKotor = true;
+        }
+        
         // Hapus semua edge yang menuju ke halte ini dari halte lain
         for (auto& pair : graph) {
             vector<Edge>& edges = pair.second;
@@ -105,6 +192,11 @@ public:
         // Tambahkan edge sebaliknya untuk membuat graf tidak berarah
         graph[halteTujuan].push_back(Edge(halteAsal, jarak));
         
+        // Perbarui indeks konektivitas secara inkremental
+        if (!indeksKotor) {
+            gabungKomponen(halteAsal, halteTujuan);
+        }
+        
         cout << "Rute dari " << halteAsal << " ke " << halteTujuan 
             << " dengan jarak " << jarak << " berhasil ditambahkan." << endl;
     }
@@ -138,6 +230,7 @@ public:
         }
         
         if (ruteAda) {
+            indeksKotor = true;
             cout << "Rute antara " << halteAsal << " dan " << halteTujuan << " berhasil dihapus." << endl;
         } else {
             cout << "Rute antara " << halteAsal << " dan " << halteTujuan << " tidak ditemukan." << endl;
@@ -198,6 +291,13 @@ public:
             return;
         }
         
+        // Cek indeks konektivitas terlebih dahulu agar halte yang tidak
+        // terhubung langsung dijawab tanpa menjelajahi seluruh komponen
+        if (!terhubung(asal, tujuan)) {
+            cout << "Tidak ada rute dari " << asal << " ke " << tujuan << endl;
+            return;
+        }
+        
         // Inisialisasi jarak dari asal ke semua node dengan infinity
         unordered_map<string, int> jarak;
         unordered_map<string, string> previous; // Untuk melacak jalur
@@ -263,6 +363,109 @@ public:
         }
     }
     
+    // Method untuk memeriksa apakah dua halte berada dalam komponen yang sama
+    bool terhubung(const string& a, const string& b) {
+        if (graph.find(a) == graph.end() || graph.find(b) == graph.end()) {
+            return false;
+        }
+        pastikanIndeksValid();
+        return cariAkar(a) == cariAkar(b);
+    }
+    
+    // Method untuk mendapatkan jumlah komponen terhubung dalam jaringan
+    int hitungKomponen() {
+        pastikanIndeksValid();
+        return jumlahKomponen;
+    }
+    
+    // Method untuk mencari halte artikulasi, yaitu halte yang jika dihapus
+    // akan memecah jaringan (algoritma Tarjan, DFS iteratif)
+    vector<string> cariHalteArtikulasi() {
+        // Petakan nama halte ke indeks agar DFS bekerja pada array
+        vector<string> namaHalte;
+        unordered_map<string, int> indeks;
+        for (const auto& pair : graph) {
+            indeks[pair.first] = namaHalte.size();
+            namaHalte.push_back(pair.first);
+        }
+        int n = namaHalte.size();
+        vector<vector<int>> tetangga(n);
+        for (const auto& pair : graph) {
+            for (const Edge& edge : pair.second) {
+                tetangga[indeks[pair.first]].push_back(indeks[edge.tujuan]);
+            }
+        }
+        
+        vector<int> waktuKunjung(n, -1), low(n, 0), induk(n, -1), jumlahAnak(n, 0);
+        vector<size_t> posisi(n, 0);
+        vector<bool> artikulasi(n, false);
+        int waktu = 0;
+        
+        for (int akar = 0; akar < n; akar++) {
+            if (waktuKunjung[akar] != -1) continue;
+            
+            vector<int> stack;
+            stack.push_back(akar);
+            waktuKunjung[akar] = low[akar] = waktu++;
+            
+            while (!stack.empty()) {
+                int u = stack.back();
+                if (posisi[u] < tetangga[u].size()) {
+                    int v = tetangga[u][posisi[u]++];
+                    if (waktuKunjung[v] == -1) {
+                        induk[v] = u;
+                        jumlahAnak[u]++;
+                        waktuKunjung[v] = low[v] = waktu++;
+                        stack.push_back(v);
+                    } else if (v != induk[u]) {
+                        low[u] = min(low[u], waktuKunjung[v]);
+                    }
+                } else {
+                    stack.pop_back();
+                    int p = induk[u];
+                    if (p != -1) {
+                        low[p] = min(low[p], low[u]);
+                        // Selain akar, p adalah artikulasi jika subtree u
+                        // tidak punya jalur balik ke atas p
+                        if (induk[p] != -1 && low[u] >= waktuKunjung[p]) {
+                            artikulasi[p] = true;
+                        }
+                    }
+                }
+            }
+            
+            // Akar DFS adalah artikulasi jika memiliki lebih dari satu anak
+            artikulasi[akar] = jumlahAnak[akar] > 1;
+        }
+        
+        vector<string> hasil;
+        for (int i = 0; i < n; i++) {
+            if (artikulasi[i]) hasil.push_back(namaHalte[i]);
+        }
+        sort(hasil.begin(), hasil.end());
+        return hasil;
+    }
+    
+    // Method untuk menampilkan informasi konektivitas jaringan
+    void tampilkanInfoKonektivitas() {
+        vector<string> artikulasi = cariHalteArtikulasi();
+        
+        cout << "\n=== KONEKTIVITAS JARINGAN ===" << endl;
+        cout << left << setw(20) << "Jumlah Halte:" << graph.size() << endl;
+        cout << left << setw(20) << "Jumlah Komponen:" << hitungKomponen() << endl;
+        cout << left << setw(20) << "Halte Artikulasi:" << artikulasi.size() << endl;
+        cout << string(40, '-') << endl;
+        
+        if (artikulasi.empty()) {
+            cout << "Tidak ada halte yang dapat memecah jaringan." << endl;
+            return;
+        }
+        
+        for (size_t i = 0; i < artikulasi.size(); i++) {
+            cout << left << setw(5) << (to_string(i + 1) + ".") << artikulasi[i] << endl;
+        }
+    }
+    
     // Method untuk menghitung jumlah penumpang per rute
     void hitungPenumpangPerRute() {
         // Clear data sebelumnya
@@ -367,11 +570,476 @@ void tampilkanMenu() {
     cout << "10. Hapus Rute" << endl;
     cout << "11. Hapus Penumpang" << endl;
     cout << "12. Keluar" << endl;
+    cout << "13. Info Konektivitas Jaringan" << endl;
     cout << "======================================" << endl;
     cout << "Pilihan Anda: ";
 }
 
-int main() {
+// ===================== MODE SERVER =====================
+// Protokol berbasis baris: satu perintah per baris, argumen dipisah '|'
+// karena nama halte dapat mengandung spasi. Contoh:
+//   RUTE Jakarta Kota|Bogor
+//   TAMBAH_PENUMPANG 11|Nama|Gambir|Depok|aktif
+//   TERHUBUNG Bogor|Bekasi
+// Setiap respons diawali header "OK <n>\n" atau "ERR <n>\n" lalu diikuti
+// n byte keluaran, sehingga klien dapat mengirim banyak perintah sekaligus
+// (pipelining) dan membaca respons secara berurutan.
+
+// Function untuk memecah argumen perintah berdasarkan pemisah '|'
+vector<string> pisahArgumen(const string& teks) {
+    vector<string> hasil;
+    size_t awal = 0;
+    while (true) {
+        size_t posisi = teks.find('|', awal);
+        if (posisi == string::npos) {
+            hasil.push_back(teks.substr(awal));
+            break;
+        }
+        hasil.push_back(teks.substr(awal, posisi - awal));
+        awal = posisi + 1;
+    }
+    return hasil;
+}
+
+// Batas jarak satu rute agar total jarak Dijkstra tetap jauh di bawah INT_MAX
+const int BATAS_JARAK = 1000000;
+
+// Function untuk mengurai bilangan bulat dalam rentang [minimum, maksimum].
+// Seluruh teks harus berupa angka; tanda, spasi, dan sisa karakter ditolak
+bool uraiBilangan(const string& teks, long minimum, long maksimum, int& hasil) {
+    if (teks.empty() || teks[0] < '0' || teks[0] > '9') return false;
+    errno = 0;
+    char* akhir = nullptr;
+    long nilai = strtol(teks.c_str(), &akhir, 10);
+    if (errno != 0 || *akhir != '\0' || nilai < minimum || nilai > maksimum) return false;
+    hasil = (int)nilai;
+    return true;
+}
+
+// Function untuk menjalankan satu perintah dan mengembalikan respons berbingkai
+string prosesPerintah(GoBusNet& sistem, const string& baris) {
+    size_t spasi = baris.find(' ');
+    string perintah = baris.substr(0, spasi);
+    vector<string> arg;
+    if (spasi != string::npos) {
+        arg = pisahArgumen(baris.substr(spasi + 1));
+    }
+
+    // Alihkan cout ke buffer agar keluaran method dapat dikirim ke klien
+    ostringstream tangkap;
+    streambuf* bufferLama = cout.rdbuf(tangkap.rdbuf());
+    bool berhasil = true;
+    int id, jarak;
+
+    // Semua argumen wajib diisi, misalnya "TAMBAH_HALTE " atau "RUTE |X" ditolak
+    bool adaArgumenKosong = false;
+    for (const string& a : arg) {
+        if (a.empty()) adaArgumenKosong = true;
+    }
+
+    // Exception dari dalam method (mis. invarian indeks yang rusak) sengaja
+    // tidak ditangkap di sini; cout cukup dikembalikan sebelum diteruskan
+    try {
+        if (adaArgumenKosong) {
+            berhasil = false;
+            cout << "Argumen tidak boleh kosong." << endl;
+        } else if (perintah == "PING" && arg.empty()) {
+            cout << "PONG" << endl;
+        } else if (perintah == "RUTE" && arg.size() == 2) {
+            sistem.cariRuteTerpendek(arg[0], arg[1]);
+        } else if (perintah == "TAMBAH_HALTE" && arg.size() == 1) {
+            sistem.tambahHalte(arg[0]);
+        } else if (perintah == "HAPUS_HALTE" && arg.size() == 1) {
+            sistem.hapusHalte(arg[0]);
+        } else if (perintah == "TAMBAH_RUTE" && arg.size() == 3) {
+            if (uraiBilangan(arg[2], 1, BATAS_JARAK, jarak)) {
+                sistem.tambahRute(arg[0], arg[1], jarak);
+            } else {
+                berhasil = false;
+                cout << "Jarak harus bilangan bulat 1-" << BATAS_JARAK << "." << endl;
+            }
+        } else if (perintah == "HAPUS_RUTE" && arg.size() == 2) {
+            sistem.hapusRute(arg[0], arg[1]);
+        } else if ((perintah == "TAMBAH_PENUMPANG" && arg.size() == 5) ||
+                   ((perintah == "CARI_PENUMPANG" || perintah == "HAPUS_PENUMPANG") && arg.size() == 1)) {
+            if (!uraiBilangan(arg[0], 1, INT_MAX, id)) {
+                berhasil = false;
+                cout << "ID penumpang harus bilangan bulat 1-" << INT_MAX << "." << endl;
+            } else if (perintah == "TAMBAH_PENUMPANG") {
+                sistem.tambahPenumpang(id, arg[1], arg[2], arg[3], arg[4]);
+            } else if (perintah == "CARI_PENUMPANG") {
+                sistem.cariPenumpang(id);
+            } else {
+                sistem.hapusPenumpang(id);
+            }
+        } else if (perintah == "TERHUBUNG" && arg.size() == 2) {
+            cout << (sistem.terhubung(arg[0], arg[1]) ? "ya" : "tidak") << endl;
+        } else if (perintah == "KONEKTIVITAS" && arg.empty()) {
+            sistem.tampilkanInfoKonektivitas();
+        } else if (perintah == "PERINGKAT" && arg.empty()) {
+            sistem.urutkanRuteBerdasarkanPenumpang();
+        } else if (perintah == "HALTE" && arg.empty()) {
+            sistem.tampilkanSemuaHalte();
+        } else if (perintah == "PENUMPANG" && arg.empty()) {
+            sistem.tampilkanSemuaPenumpang();
+        } else {
+            berhasil = false;
+            cout << "Perintah tidak dikenal atau jumlah argumen salah: " << perintah << endl;
+        }
+    } catch (...) {
+        cout.rdbuf(bufferLama);
+        throw;
+    }
+
+    cout.rdbuf(bufferLama);
+
+    string isi = tangkap.str();
+    return (berhasil ? "OK " : "ERR ") + to_string(isi.size()) + "\n" + isi;
+}
+
+#ifdef __linux__
+// Batas data masuk yang ditampung per koneksi, mencegah klien menghabiskan memori
+const size_t BATAS_BUFFER_MASUK = 1 << 20;
+
+// Batas respons tertunda per koneksi; pemrosesan baris berhenti saat
+// bufferKeluar mencapai batas ini sampai klien membaca responsnya
+const size_t BATAS_BUFFER_KELUAR = 1 << 20;
+
+// Lama penundaan accept setelah gagal karena kehabisan sumber daya (EMFILE dsb.)
+const int TUNDA_ACCEPT_MS = 100;
+
+// Struktur untuk menyimpan state tiap koneksi klien
+struct Koneksi {
+    string bufferMasuk;   // Data masuk yang belum membentuk baris lengkap
+    string bufferKeluar;  // Respons yang belum terkirim
+    size_t offsetKeluar;  // Posisi kirim berikutnya di bufferKeluar
+    bool tutup;           // Tutup koneksi setelah semua respons terkirim
+
+    Koneksi() : offsetKeluar(0), tutup(false) {}
+};
+
+// Function untuk mengubah file descriptor menjadi non-blocking
+bool aturNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// Function untuk mencetak kegagalan system call beserta errno-nya
+void laporkanGagal(const string& langkah, const string& alamat) {
+    cerr << "Gagal " << langkah << " " << alamat << ": " << strerror(errno) << endl;
+}
+
+// Function untuk membuka socket pendengar. Alamat diawali '/' berarti
+// Unix domain socket, selain itu dianggap nomor port TCP di 127.0.0.1.
+// Pesan kesalahan dicetak di sini, pemanggil cukup memeriksa nilai -1
+int bukaSocketServer(const string& alamat) {
+    int fd;
+    if (!alamat.empty() && alamat[0] == '/') {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        if (alamat.size() >= sizeof(addr.sun_path)) {
+            cerr << "Path socket terlalu panjang: " << alamat << endl;
+            return -1;
+        }
+
+        // Hanya hapus sisa socket dari proses sebelumnya, jangan pernah
+        // menghapus file biasa yang kebetulan berada di path tersebut
+        struct stat info;
+        if (lstat(alamat.c_str(), &info) == 0) {
+            if (!S_ISSOCK(info.st_mode)) {
+                cerr << "Path " << alamat << " sudah ada dan bukan socket, tidak akan ditimpa." << endl;
+                return -1;
+            }
+            if (unlink(alamat.c_str()) < 0) {
+                laporkanGagal("menghapus socket lama", alamat);
+                return -1;
+            }
+        } else if (errno != ENOENT) {
+            laporkanGagal("memeriksa path", alamat);
+            return -1;
+        }
+
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            laporkanGagal("membuat socket untuk", alamat);
+            return -1;
+        }
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, alamat.c_str());
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            laporkanGagal("bind ke", alamat);
+            close(fd);
+            return -1;
+        }
+    } else {
+        int port;
+        if (!uraiBilangan(alamat, 1, 65535, port)) {
+            cerr << "Port tidak valid (harus 1-65535): " << alamat << endl;
+            return -1;
+        }
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            laporkanGagal("membuat socket untuk port", alamat);
+            return -1;
+        }
+        int aktif = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &aktif, sizeof(aktif));
+        sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(fd, (sockaddr*)&addr, sizeof(addr)) < 0) {
+            laporkanGagal("bind ke port", alamat);
+            close(fd);
+            return -1;
+        }
+    }
+
+    if (listen(fd, SOMAXCONN) < 0 || !aturNonBlocking(fd)) {
+        laporkanGagal("listen di", alamat);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Function untuk mengirim sebanyak mungkin isi bufferKeluar tanpa blocking.
+// Mengembalikan false jika koneksi bermasalah dan harus ditutup
+bool kirimBuffer(int fd, Koneksi& k) {
+    while (k.offsetKeluar < k.bufferKeluar.size()) {
+        ssize_t n = send(fd, k.bufferKeluar.data() + k.offsetKeluar,
+                         k.bufferKeluar.size() - k.offsetKeluar, MSG_NOSIGNAL);
+        if (n > 0) {
+            k.offsetKeluar += n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        } else {
+            return false;
+        }
+    }
+    k.bufferKeluar.clear();
+    k.offsetKeluar = 0;
+    return true;
+}
+
+// Function untuk menjalankan server event-driven berbasis epoll
+int jalankanServer(GoBusNet& sistem, const string& alamat) {
+    int fdServer = bukaSocketServer(alamat);
+    if (fdServer < 0) {
+        return 1;
+    }
+    bool modeTcp = alamat.empty() || alamat[0] != '/';
+
+    int epfd = epoll_create1(0);
+    if (epfd < 0) {
+        cerr << "Gagal membuat epoll: " << strerror(errno) << endl;
+        close(fdServer);
+        return 1;
+    }
+    epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.fd = fdServer;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, fdServer, &ev);
+
+    unordered_map<int, Koneksi> daftarKoneksi;
+    vector<epoll_event> events(128);
+    vector<char> bufferBaca(64 * 1024);
+
+    cout << "Server GoBusNet mendengarkan di " << alamat << endl;
+
+    // Saat accept gagal karena kehabisan sumber daya, socket pendengar tetap
+    // readable; minatnya dimatikan sementara agar loop tidak berputar terus
+    bool acceptDitunda = false;
+    chrono::steady_clock::time_point waktuLanjutAccept;
+
+    auto aturMinatServer = [&](uint32_t minat) {
+        epoll_event e;
+        memset(&e, 0, sizeof(e));
+        e.events = minat;
+        e.data.fd = fdServer;
+        epoll_ctl(epfd, EPOLL_CTL_MOD, fdServer, &e);
+    };
+
+    // Tutup koneksi dan lepaskan dari epoll
+    auto tutupKoneksi = [&](int fd) {
+        epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+        daftarKoneksi.erase(fd);
+    };
+
+    // Selama masih ada respons tertunda, hanya tunggu EPOLLOUT agar klien
+    // yang lambat membaca tidak membuat bufferKeluar tumbuh tanpa batas
+    auto perbaruiMinat = [&](int fd, const Koneksi& k) {
+        epoll_event e;
+        memset(&e, 0, sizeof(e));
+        e.events = k.bufferKeluar.empty() ? EPOLLIN : EPOLLOUT;
+        e.data.fd = fd;
+        epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &e);
+    };
+
+    // Proses baris lengkap di bufferMasuk; responsnya dikumpulkan untuk
+    // dikirim dalam satu batch. Berhenti saat bufferKeluar mencapai batas,
+    // sisa baris diproses setelah respons sebelumnya terkirim
+    auto prosesBaris = [&](Koneksi& k) {
+        size_t awal = 0;
+        while (k.bufferKeluar.size() < BATAS_BUFFER_KELUAR) {
+            size_t akhir = k.bufferMasuk.find('\n', awal);
+            if (akhir == string::npos) break;
+            string baris = k.bufferMasuk.substr(awal, akhir - awal);
+            awal = akhir + 1;
+            if (!baris.empty() && baris.back() == '\r') baris.pop_back();
+            if (baris.empty()) continue;
+            if (baris == "KELUAR") {
+                // Abaikan perintah setelah KELUAR
+                k.tutup = true;
+                awal = k.bufferMasuk.size();
+                break;
+            }
+            k.bufferKeluar += prosesPerintah(sistem, baris);
+        }
+        k.bufferMasuk.erase(0, awal);
+    };
+
+    while (true) {
+        int batasTunggu = -1;
+        if (acceptDitunda) {
+            auto sisa = chrono::duration_cast<chrono::milliseconds>(
+                waktuLanjutAccept - chrono::steady_clock::now()).count();
+            if (sisa <= 0) {
+                acceptDitunda = false;
+                aturMinatServer(EPOLLIN);
+            } else {
+                batasTunggu = (int)sisa;
+            }
+        }
+
+        int jumlah = epoll_wait(epfd, events.data(), (int)events.size(), batasTunggu);
+        if (jumlah < 0) {
+            if (errno == EINTR) continue;
+            cerr << "epoll_wait gagal: " << strerror(errno) << endl;
+            break;
+        }
+
+        for (int i = 0; i < jumlah; i++) {
+            int fd = events[i].data.fd;
+
+            // Terima semua koneksi baru yang sedang menunggu
+            if (fd == fdServer) {
+                while (true) {
+                    int fdKlien = accept4(fdServer, nullptr, nullptr, SOCK_NONBLOCK);
+                    if (fdKlien < 0) {
+                        if (errno == EINTR || errno == ECONNABORTED) continue;
+                        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                            cerr << "accept gagal: " << strerror(errno)
+                                 << ", penerimaan koneksi ditunda " << TUNDA_ACCEPT_MS << " ms" << endl;
+                            acceptDitunda = true;
+                            waktuLanjutAccept = chrono::steady_clock::now() +
+                                chrono::milliseconds(TUNDA_ACCEPT_MS);
+                            aturMinatServer(0);
+                        }
+                        break;
+                    }
+                    if (modeTcp) {
+                        int aktif = 1;
+                        setsockopt(fdKlien, IPPROTO_TCP, TCP_NODELAY, &aktif, sizeof(aktif));
+                    }
+                    epoll_event e;
+                    memset(&e, 0, sizeof(e));
+                    e.events = EPOLLIN;
+                    e.data.fd = fdKlien;
+                    epoll_ctl(epfd, EPOLL_CTL_ADD, fdKlien, &e);
+                    daftarKoneksi[fdKlien] = Koneksi();
+                }
+                continue;
+            }
+
+            auto it = daftarKoneksi.find(fd);
+            if (it == daftarKoneksi.end()) continue;
+            Koneksi& k = it->second;
+
+            if (events[i].events & EPOLLERR) {
+                tutupKoneksi(fd);
+                continue;
+            }
+
+            if ((events[i].events & (EPOLLIN | EPOLLHUP)) && !k.tutup) {
+                // Baca data yang tersedia, tetapi berhenti begitu bufferMasuk
+                // mencapai batas; sisanya menunggu event berikutnya
+                while (k.bufferMasuk.size() < BATAS_BUFFER_MASUK) {
+                    ssize_t n = recv(fd, bufferBaca.data(), bufferBaca.size(), 0);
+                    if (n > 0) {
+                        k.bufferMasuk.append(bufferBaca.data(), n);
+                    } else if (n == 0) {
+                        k.tutup = true;
+                        break;
+                    } else if (errno == EINTR) {
+                        continue;
+                    } else {
+                        if (errno != EAGAIN && errno != EWOULDBLOCK) k.tutup = true;
+                        break;
+                    }
+                }
+            }
+
+            // Proses dan kirim bergantian sampai baris habis atau socket penuh,
+            // sehingga bufferKeluar tidak pernah jauh melewati batasnya
+            bool gagalKirim = false;
+            while (true) {
+                prosesBaris(k);
+                if (!kirimBuffer(fd, k)) {
+                    gagalKirim = true;
+                    break;
+                }
+                if (!k.bufferKeluar.empty() || k.bufferMasuk.find('\n') == string::npos) break;
+            }
+            if (gagalKirim) {
+                tutupKoneksi(fd);
+                continue;
+            }
+
+            // Semua baris lengkap sudah diproses tetapi sisa data tetap
+            // mencapai batas, berarti satu baris terlalu panjang
+            if (k.bufferKeluar.empty() && k.bufferMasuk.size() >= BATAS_BUFFER_MASUK) {
+                k.bufferKeluar = "ERR 23\nBaris terlalu panjang.\n";
+                k.bufferMasuk.clear();
+                k.tutup = true;
+                if (!kirimBuffer(fd, k)) {
+                    tutupKoneksi(fd);
+                    continue;
+                }
+            }
+
+            if (k.bufferKeluar.empty() && k.tutup) {
+                tutupKoneksi(fd);
+                continue;
+            }
+            perbaruiMinat(fd, k);
+        }
+    }
+
+    close(epfd);
+    close(fdServer);
+    return 1;
+}
+#else
+// Mode server memerlukan epoll sehingga hanya tersedia di Linux
+int jalankanServer(GoBusNet&, const string&) {
+    cerr << "Mode server hanya tersedia di Linux." << endl;
+    return 1;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+    // Validasi argumen mode server sebelum inisialisasi data
+    if (argc >= 2 && string(argv[1]) == "--server" && argc != 3) {
+        cerr << "Penggunaan: " << argv[0] << " --server <port | /path/socket>" << endl;
+        return 1;
+    }
+    
     // Inisialisasi objek sistem GoBusNet
     GoBusNet sistem;
     int pilihan;
@@ -556,6 +1224,12 @@ int main() {
     sistem.tambahPenumpang(9, "Doni Saputra", "Kebayoran", "Parung Panjang", "aktif");
     sistem.tambahPenumpang(10, "Fitri Handayani", "Tebet", "Citayam", "non-aktif");
     
+    // Mode server: layani permintaan lewat socket alih-alih menu interaktif
+    // Penggunaan: ./main --server <port | /path/socket>
+    if (argc == 3 && string(argv[1]) == "--server") {
+        return jalankanServer(sistem, argv[2]);
+    }
+    
     // Loop utama program
     do {
         tampilkanMenu();
@@ -668,6 +1342,11 @@ int main() {
                 cout << "Terima kasih telah menggunakan sistem GoBusNet!" << endl;
                 break;
             }
+            case 13: {
+                // Tampilkan jumlah komponen dan halte artikulasi
+                sistem.tampilkanInfoKonektivitas();
+                break;
+            }
             default: {
                 cout << "Pilihan tidak valid. Silakan coba lagi." << endl;
                 break;